@@ -1,14 +1,16 @@
 #include "../segTree.hpp"
+#include "../fastIO.hpp"
 #include <bits/stdc++.h>
 
 int main() {
-  std::ios::sync_with_stdio(false);
-  std::cin.tie(nullptr);
+  FastReader in;
+  FastWriter out;
 
   int n, m;
-  std::cin >> n >> m;
+  in.read(n);
+  in.read(m);
   std::vector<int> a(n);
-  for (auto &i : a) std::cin >> i;
+  for (auto &i : a) in.read(i);
 
   segTree<int> segMax(a, MAX);
 
@@ -25,8 +27,8 @@ int main() {
     c.push_back(segMin.query(i, i + m - 1));
 
   for (int i = 0; i < c.size(); i++) {
-    if (i) std::cout << ' ';
-    std::cout << c[i];
+    if (i) out.writeChar(' ');
+    out.write(c[i]);
   }
-  std::cout << '\n';
+  out.writeChar('\n');
 }
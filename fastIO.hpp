@@ -0,0 +1,269 @@
+/*
+ * Entrada e saída rápidas para os exemplos e benchmarks
+ *
+ * - FastReader: mapeia a entrada inteira na memória (mmap) quando ela é
+ *   um arquivo comum; para pipes e terminais lê tudo com read(). Os
+ *   inteiros são convertidos 8 dígitos por vez com SWAR (SIMD dentro de
+ *   um registrador de 64 bits). Também lê valores binários crus em
+ *   little-endian, sem conversão nenhuma.
+ * - FastWriter: acumula a saída num buffer e converte inteiros usando
+ *   uma tabela de dois dígitos, chamando write() só quando o buffer enche.
+ *
+ * Depende de POSIX (mmap, read, write).
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <bit>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+class FastReader
+{
+private:
+    const char* dados; // início da entrada
+    size_t tamanho;    // tamanho da entrada em bytes
+    size_t pos;        // próximo byte a ser lido
+    bool mapeado;      // 'dados' veio de mmap e precisa de munmap
+    int fd_proprio;    // fd aberto pelo próprio leitor, -1 se não for o caso
+    std::vector<char> copia; // entrada lida com read() quando não dá pra mapear
+
+    static constexpr uint64_t UNS = 0x0101010101010101ULL;
+    static constexpr uint64_t ALTOS = 0x8080808080808080ULL;
+
+    void carrega(int fd) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 and S_ISREG(info.st_mode) and info.st_size > 0) {
+            void* p = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, info.st_size, MADV_SEQUENTIAL);
+                dados = static_cast<const char*>(p);
+                tamanho = info.st_size;
+                mapeado = true;
+                return;
+            }
+        }
+
+        // Pipe, terminal ou mmap falhou: lê tudo para a memória
+        size_t lido = 0;
+        copia.resize(1 << 16);
+        while (true) {
+            if (lido == copia.size()) copia.resize(copia.size() * 2);
+            ssize_t r = ::read(fd, copia.data() + lido, copia.size() - lido);
+            if (r <= 0) break;
+            lido += r;
+        }
+        copia.resize(lido);
+        dados = copia.data();
+        tamanho = lido;
+    }
+
+    // Bytes que não são dígitos ('0'..'9') ficam com o bit alto ligado.
+    // Só o byte marcado mais baixo é exato (o empréstimo/vai-um sobe para
+    // os bytes seguintes), e é só ele que interessa: o fim do número.
+    static uint64_t naoDigitos(uint64_t v) {
+        uint64_t menor = (v - UNS * '0') & ~v & ALTOS;
+        uint64_t maior = ((v + UNS * (127 - '9')) | v) & ALTOS;
+        return menor | maior;
+    }
+
+    // Converte 8 dígitos já sem o '0' (primeiro dígito no byte mais baixo)
+    static uint32_t oitoDigitos(uint64_t v) {
+        v = (v * 10) + (v >> 8);
+        v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+        return v;
+    }
+
+    template<typename U>
+    U digitos() {
+        static constexpr uint32_t pot10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+        U res = 0;
+
+        if constexpr (std::endian::native == std::endian::little) {
+            // Blocos de até 8 dígitos enquanto couber uma palavra inteira
+            while (pos + 8 <= tamanho) {
+                uint64_t v;
+                std::memcpy(&v, dados + pos, 8);
+
+                uint64_t fim = naoDigitos(v);
+                int k = fim ? std::countr_zero(fim) / 8 : 8;
+                if (k == 0) return res;
+
+                // Descarta os bytes depois do número e completa com zeros
+                // à esquerda, assim qualquer k entre 1 e 8 vira 8 dígitos
+                v = (v - UNS * '0') << (8 * (8 - k));
+                res = res * pot10[k] + oitoDigitos(v);
+                pos += k;
+                if (k < 8) return res;
+            }
+        }
+
+        // Final da entrada (ou máquina big-endian): um dígito por vez
+        while (pos < tamanho and dados[pos] >= '0' and dados[pos] <= '9') {
+            res = res * 10 + (dados[pos] - '0');
+            pos++;
+        }
+        return res;
+    }
+
+public:
+    explicit FastReader(int fd = 0) :
+        dados(nullptr), tamanho(0), pos(0), mapeado(false), fd_proprio(-1)
+    {
+        carrega(fd);
+    }; //lê do descritor 'fd' (0 = entrada padrão)
+
+    explicit FastReader(const char* caminho) :
+        dados(nullptr), tamanho(0), pos(0), mapeado(false), fd_proprio(open(caminho, O_RDONLY))
+    {
+        if (fd_proprio >= 0) carrega(fd_proprio);
+    }; //lê do arquivo em 'caminho'
+
+    FastReader(const FastReader&) = delete;
+    FastReader& operator=(const FastReader&) = delete;
+
+    ~FastReader() {
+        if (mapeado) munmap(const_cast<char*>(dados), tamanho);
+        if (fd_proprio >= 0) close(fd_proprio);
+    }
+
+    // Lê o próximo inteiro em texto decimal (com sinal opcional) e consome
+    // o separador logo depois dele (um espaço, tab ou fim de linha; "\r\n"
+    // conta como um só), assim um readBinary em seguida começa no primeiro
+    // byte depois do cabeçalho. Retorna false se a entrada acabou antes de
+    // achar um número.
+    template<typename T>
+    bool read(T& x) {
+        static_assert(std::is_integral_v<T>, "FastReader::read só lê inteiros");
+
+        while (pos < tamanho and (dados[pos] < '0' or dados[pos] > '9') and dados[pos] != '-') pos++;
+        if (pos == tamanho) return false;
+
+        bool negativo = false;
+        if (dados[pos] == '-') {
+            negativo = true;
+            pos++;
+        }
+
+        using U = std::make_unsigned_t<T>;
+        U valor = digitos<U>();
+        x = negativo ? static_cast<T>(U(0) - valor) : static_cast<T>(valor);
+
+        if (pos < tamanho and (dados[pos] == ' ' or dados[pos] == '\t' or dados[pos] == '\n' or dados[pos] == '\r')) {
+            if (dados[pos] == '\r' and pos + 1 < tamanho and dados[pos + 1] == '\n') pos++;
+            pos++;
+        }
+        return true;
+    }
+
+    // Lê até 'count' valores binários crus em little-endian a partir da
+    // posição atual. Retorna quantos valores inteiros foram lidos.
+    template<typename T>
+    size_t readBinary(T* out, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "FastReader::readBinary precisa de um tipo trivial");
+
+        size_t disponiveis = (tamanho - pos) / sizeof(T);
+        if (count > disponiveis) count = disponiveis;
+
+        std::memcpy(out, dados + pos, count * sizeof(T));
+        pos += count * sizeof(T);
+
+        if constexpr (std::endian::native == std::endian::big) {
+            for (size_t i = 0; i < count; i++) {
+                unsigned char* b = reinterpret_cast<unsigned char*>(out + i);
+                for (size_t j = 0; j < sizeof(T) / 2; j++) std::swap(b[j], b[sizeof(T) - 1 - j]);
+            }
+        }
+        return count;
+    }
+};
+
+class FastWriter
+{
+private:
+    int fd;                 // destino da saída
+    std::vector<char> buf;  // saída ainda não escrita
+    size_t usado;           // bytes ocupados em 'buf'
+
+    static constexpr size_t MARGEM = 64; // cabe qualquer inteiro de 128 bits
+
+    // "00" "01" ... "99": converte dois dígitos por vez
+    static constexpr char PARES[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    void garante(size_t n) {
+        if (usado + n > buf.size()) flush();
+    }
+
+public:
+    explicit FastWriter(int fd = 1, size_t capacidade = 1 << 16) :
+        fd(fd), buf(std::max(capacidade, 2 * MARGEM)), usado(0) {}; //escreve no descritor 'fd' (1 = saída padrão)
+
+    FastWriter(const FastWriter&) = delete;
+    FastWriter& operator=(const FastWriter&) = delete;
+
+    ~FastWriter() {
+        flush();
+    }
+
+    void flush() {
+        size_t escrito = 0;
+        while (escrito < usado) {
+            ssize_t r = ::write(fd, buf.data() + escrito, usado - escrito);
+            if (r <= 0) break;
+            escrito += r;
+        }
+        usado = 0;
+    }; //manda o conteúdo do buffer para o descritor
+
+    void writeChar(char c) {
+        garante(1);
+        buf[usado++] = c;
+    }; //escreve um caractere
+
+    template<typename T>
+    void write(T x) {
+        static_assert(std::is_integral_v<T>, "FastWriter::write só escreve inteiros");
+        garante(MARGEM);
+
+        using U = std::make_unsigned_t<T>;
+        U valor = static_cast<U>(x);
+        if constexpr (std::is_signed_v<T>) {
+            if (x < 0) {
+                buf[usado++] = '-';
+                valor = U(0) - valor;
+            }
+        }
+
+        // Monta os dígitos de trás pra frente num buffer temporário
+        char tmp[MARGEM];
+        char* fim = tmp + MARGEM;
+        char* p = fim;
+        while (valor >= 100) {
+            unsigned d = valor % 100;
+            valor /= 100;
+            p -= 2;
+            std::memcpy(p, PARES + 2 * d, 2);
+        }
+        if (valor >= 10) {
+            p -= 2;
+            std::memcpy(p, PARES + 2 * valor, 2);
+        } else {
+            *--p = '0' + valor;
+        }
+
+        std::memcpy(buf.data() + usado, p, fim - p);
+        usado += fim - p;
+    }; //escreve 'x' em decimal
+};
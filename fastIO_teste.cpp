@@ -0,0 +1,259 @@
+#include "fastIO.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+// Arquivos temporários usados pelos testes
+const char* ARQ_TEXTO = "/tmp/fastIO_teste.txt";
+const char* ARQ_BINARIO = "/tmp/fastIO_teste.bin";
+const char* ARQ_SAIDA = "/tmp/fastIO_teste.out";
+
+void escreveTexto(const char* caminho, const std::string& conteudo) {
+    std::ofstream f(caminho, std::ios::binary);
+    f << conteudo;
+}
+
+std::string leArquivo(const char* caminho) {
+    std::ifstream f(caminho, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+// Casos de borda do leitor de texto: sinais, zeros, números com mais de
+// 8 dígitos, limites do tipo e número encostado no fim do arquivo
+void testLeitura() {
+    std::cout << "🧪 Testando FastReader::read...\n";
+
+    std::vector<long long> esperados = {
+        0, 7, -7, 12345678, 123456789, -987654321012LL, 100000000,
+        std::numeric_limits<long long>::max(), std::numeric_limits<long long>::min(),
+        42, 1, 99999999, 10
+    };
+    std::string texto = "0 7\n-7\t12345678  123456789\r\n-987654321012 100000000 ";
+    texto += std::to_string(esperados[7]) + " " + std::to_string(esperados[8]);
+    texto += "\n\n   42 1 99999999 10"; // sem '\n' no final
+
+    escreveTexto(ARQ_TEXTO, texto);
+    FastReader in(ARQ_TEXTO);
+    for (long long esperado : esperados) {
+        long long x;
+        assert(in.read(x));
+        if (x != esperado) {
+            std::cout << "❌ ERRO: lido " << x << " esperado " << esperado << std::endl;
+            assert(false);
+        }
+    }
+    long long x;
+    assert(!in.read(x));
+
+    // Vários valores aleatórios contra o iostream
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> dist(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    std::string grande;
+    std::vector<int> valores(100000);
+    for (auto& v : valores) {
+        v = dist(gen) >> (gen() % 32);
+        grande += std::to_string(v);
+        grande += (gen() % 4 == 0) ? '\n' : ' ';
+    }
+    escreveTexto(ARQ_TEXTO, grande);
+
+    FastReader in2(ARQ_TEXTO);
+    for (int esperado : valores) {
+        int v;
+        assert(in2.read(v) and v == esperado);
+    }
+
+    std::cout << "✅ FastReader::read funcionando!\n";
+}
+
+void testBinario() {
+    std::cout << "🧪 Testando FastReader::readBinary...\n";
+
+    std::vector<int32_t> valores = {0, 1, -1, 123456, std::numeric_limits<int32_t>::min()};
+    {
+        std::ofstream f(ARQ_BINARIO, std::ios::binary);
+        for (int32_t v : valores) {
+            uint32_t u = v;
+            unsigned char b[4] = {(unsigned char)u, (unsigned char)(u >> 8),
+                                  (unsigned char)(u >> 16), (unsigned char)(u >> 24)};
+            f.write(reinterpret_cast<char*>(b), 4);
+        }
+    }
+
+    FastReader in(ARQ_BINARIO);
+    std::vector<int32_t> lidos(10);
+    assert(in.readBinary(lidos.data(), lidos.size()) == valores.size());
+    for (size_t i = 0; i < valores.size(); i++) assert(lidos[i] == valores[i]);
+
+    std::cout << "✅ FastReader::readBinary funcionando!\n";
+}
+
+// Cabeçalho em texto seguido de corpo binário: read() tem que consumir o
+// separador do cabeçalho, senão o readBinary começa um byte antes
+void testTextoEBinario() {
+    std::cout << "🧪 Testando cabeçalho em texto + corpo binário...\n";
+
+    std::vector<int32_t> valores = {1, 2, -3, 0x0A0D0A0D};
+    for (std::string cabecalho : {"4\n", "4 ", "4\r\n", "  4\t"}) {
+        {
+            std::ofstream f(ARQ_BINARIO, std::ios::binary);
+            f << cabecalho;
+            for (int32_t v : valores) {
+                uint32_t u = v;
+                unsigned char b[4] = {(unsigned char)u, (unsigned char)(u >> 8),
+                                      (unsigned char)(u >> 16), (unsigned char)(u >> 24)};
+                f.write(reinterpret_cast<char*>(b), 4);
+            }
+        }
+
+        FastReader in(ARQ_BINARIO);
+        int n;
+        assert(in.read(n) and n == (int)valores.size());
+        std::vector<int32_t> lidos(n);
+        assert(in.readBinary(lidos.data(), n) == valores.size());
+        if (lidos != valores) {
+            std::cout << "❌ ERRO: corpo binário deslocado depois do cabeçalho \"" << cabecalho << "\"" << std::endl;
+            assert(false);
+        }
+    }
+
+    std::cout << "✅ Cabeçalho em texto + corpo binário funcionando!\n";
+}
+
+void testEscrita() {
+    std::cout << "🧪 Testando FastWriter...\n";
+
+    std::vector<long long> valores = {0, 5, -5, 10, 99, 100, -100, 123456789,
+                                      std::numeric_limits<long long>::max(),
+                                      std::numeric_limits<long long>::min()};
+    std::string esperado;
+    {
+        FILE* f = std::fopen(ARQ_SAIDA, "w");
+        FastWriter out(fileno(f), 16); // buffer pequeno para forçar vários flush
+        for (long long v : valores) {
+            out.write(v);
+            out.writeChar(' ');
+            esperado += std::to_string(v) + ' ';
+        }
+        out.flush();
+        std::fclose(f);
+    }
+    assert(leArquivo(ARQ_SAIDA) == esperado);
+
+    std::cout << "✅ FastWriter funcionando!\n";
+}
+
+// Compara a vazão de iostream, FastReader em texto e FastReader binário
+void benchmarkVazao(int n) {
+    std::cout << "⚡ Benchmark de leitura/escrita (" << n << " inteiros)...\n";
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 1000000000);
+    std::vector<int> valores(n);
+    for (auto& v : valores) v = dist(gen);
+
+    // Gera os arquivos com o próprio FastWriter
+    {
+        FILE* f = std::fopen(ARQ_TEXTO, "w");
+        FastWriter out(fileno(f));
+        for (int v : valores) {
+            out.write(v);
+            out.writeChar('\n');
+        }
+        out.flush();
+        std::fclose(f);
+
+        std::ofstream bin(ARQ_BINARIO, std::ios::binary);
+        bin.write(reinterpret_cast<const char*>(valores.data()), valores.size() * sizeof(int));
+    }
+    double megabytes = leArquivo(ARQ_TEXTO).size() / 1e6;
+
+    auto mede = [](auto&& f) {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    std::vector<int> lidos(n);
+    double t_ios = mede([&]() {
+        std::ifstream f(ARQ_TEXTO);
+        for (auto& v : lidos) f >> v;
+    });
+    assert(lidos == valores);
+
+    std::fill(lidos.begin(), lidos.end(), 0);
+    double t_fast = mede([&]() {
+        FastReader in(ARQ_TEXTO);
+        for (auto& v : lidos) in.read(v);
+    });
+    assert(lidos == valores);
+
+    std::fill(lidos.begin(), lidos.end(), 0);
+    double t_bin = mede([&]() {
+        FastReader in(ARQ_BINARIO);
+        in.readBinary(lidos.data(), n);
+    });
+    assert(lidos == valores);
+
+    double t_ios_out = mede([&]() {
+        std::ofstream f(ARQ_SAIDA);
+        for (int v : valores) f << v << '\n';
+    });
+
+    double t_fast_out = mede([&]() {
+        FILE* f = std::fopen(ARQ_SAIDA, "w");
+        {
+            FastWriter out(fileno(f));
+            for (int v : valores) {
+                out.write(v);
+                out.writeChar('\n');
+            }
+        }
+        std::fclose(f);
+    });
+
+    std::cout << "   leitura iostream  : " << t_ios << "ms (" << megabytes / t_ios * 1000 << " MB/s)\n";
+    std::cout << "   leitura FastReader: " << t_fast << "ms (" << megabytes / t_fast * 1000 << " MB/s, "
+              << t_ios / t_fast << "x)\n";
+    std::cout << "   leitura binária   : " << t_bin << "ms (" << t_ios / t_bin << "x)\n";
+    std::cout << "   escrita iostream  : " << t_ios_out << "ms\n";
+    std::cout << "   escrita FastWriter: " << t_fast_out << "ms (" << t_ios_out / t_fast_out << "x)\n";
+}
+
+int main(int argc, char** argv) {
+    std::cout << "🌳 === TESTE DE ENTRADA/SAÍDA RÁPIDA ===\n\n";
+
+    // uso: ./FastIO [quantidade de inteiros]
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+
+    testLeitura();
+    std::cout << std::endl;
+
+    testBinario();
+    std::cout << std::endl;
+
+    testTextoEBinario();
+    std::cout << std::endl;
+
+    testEscrita();
+    std::cout << std::endl;
+
+    benchmarkVazao(n);
+
+    std::remove(ARQ_TEXTO);
+    std::remove(ARQ_BINARIO);
+    std::remove(ARQ_SAIDA);
+
+    std::cout << "\n🎉 TODOS OS TESTES PASSARAM!\n";
+    return 0;
+}
@@ -8,15 +8,27 @@
  * - Implement update() function
  * - Implement query() function  
  * - Add GCD operations (optional)
- * 
- * 🔄 TODO (for collaboration):
- * - Add range update with lazy propagation (advanced)
+ * - Interleaved batch queries with software prefetching
+ * - Const queries: pending lazy tags are accumulated, never pushed
+ * - Range add/assign with lazy propagation for every TreeType
+ *   (GCD range add descends to the leaves, no lazy tag)
  */
 
+#pragma once
+
 #include <vector>
 #include <algorithm>
 #include <numeric>
 #include <limits>
+#include <utility>
+
+// Prefetch de software: pede ao hardware para trazer o endereço para a
+// cache sem bloquear. Em compiladores sem o builtin vira uma operação nula.
+#if defined(__GNUC__) || defined(__clang__)
+#define SEGTREE_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define SEGTREE_PREFETCH(addr) ((void)0)
+#endif
 
 enum TreeType {
     SUM,
@@ -25,6 +37,33 @@ enum TreeType {
     GCD 
 };
 
+// Operação de cada TreeType e o seu elemento neutro. Ficam fora da classe
+// para que as árvores montadas em cima da segTree (segTreeSharded) usem
+// exatamente as mesmas definições.
+template<typename T>
+T operacaoDoTipo(TreeType type, T a, T b) {
+  switch (type) {
+    case SUM: return a + b;
+    case MAX: return std::max(a, b);
+    case MIN: return std::min(a, b);
+    case GCD: return std::gcd(a, b);
+  }
+
+  return T();
+}
+
+template<typename T>
+T valorPadraoDoTipo(TreeType type) {
+  switch (type) {
+    case SUM: return 0;
+    case MAX: return std::numeric_limits<T>::lowest();
+    case MIN: return std::numeric_limits<T>::max();
+    case GCD: return 0;
+  }
+
+  return T();
+}
+
 template<typename T>
 class segTree
 {
@@ -42,23 +81,35 @@ private:
     };
     std::vector<LazyType> lazy_type; // Tipo da operação lazy pendente
     
-    T operacao(T a, T b) {
+    T operacao(T a, T b) const {
+      return operacaoDoTipo(type, a, b);
+    }
+
+    T valorPadrao() const {
+      return valorPadraoDoTipo<T>(type);
+    }
+
+    // Valor de um nó com 'len' elementos iguais a 'val'
+    T valorIntervalo(T val, int len) const {
       switch (type) {
-        case SUM: return a + b;
-        case MAX: return std::max(a, b);
-        case MIN: return std::min(a, b);
-        case GCD: return std::gcd(a, b);
+        case SUM: return val * len;
+        case MAX: return val;
+        case MIN: return val;
+        case GCD: return val;
       }
 
       return T();
     }
 
-    T valorPadrao() {
+    // Valor de um nó com 'len' elementos depois de somar 'add' a cada um.
+    // Não existe para GCD: o mdc não anda junto com a soma, por isso
+    // rangeAdd em árvores GCD desce até as folhas em vez de usar lazy.
+    T somaIntervalo(T atual, T add, int len) const {
       switch (type) {
-        case SUM: return 0;
-        case MAX: return std::numeric_limits<T>::lowest();
-        case MIN: return std::numeric_limits<T>::max();
-        case GCD: return 0;
+        case SUM: return atual + add * len;
+        case MAX: return atual + add;
+        case MIN: return atual + add;
+        case GCD: return atual;
       }
 
       return T();
@@ -101,6 +152,10 @@ private:
             // dividir o vetor em duas metades
             int mid = (L + R) / 2;
 
+            // Aplica lazy propagation antes de descer na árvore,
+            // senão o nó seria recalculado com filhos desatualizados
+            push(node, L, R);
+
             // Precisa atualizar apenas a metade da árvore
             // que vai ter algum valor modificado
             if (pos <= mid) {
@@ -127,6 +182,10 @@ private:
             // dividir o vetor em duas metades
             int mid = (L + R) / 2;
 
+            // Aplica lazy propagation antes de descer na árvore,
+            // senão o nó seria recalculado com filhos desatualizados
+            push(node, L, R);
+
             // Precisa atualizar apenas a metade da árvore
             // que vai ter algum valor modificado
             if (pos <= mid) {
@@ -143,7 +202,38 @@ private:
         }
     }
 
-    T _query(int node, int L, int R, int l, int r)
+    // Operação lazy que os ancestrais de um nó ainda não empurraram.
+    // As consultas não chamam push(): carregam isto enquanto descem e
+    // aplicam nos valores lidos, assim nunca escrevem na árvore.
+    struct Pendente {
+        LazyType tipo;
+        T valor;
+    };
+
+    // Pendente dos filhos de 'node': primeiro a tag do próprio nó, depois
+    // o que veio de cima (as tags de cima são sempre as mais recentes)
+    Pendente compoe(Pendente acima, int node) const {
+        if (acima.tipo == LAZY_ASSIGN or lazy_type[node] == NO_LAZY) {
+            return acima;
+        }
+        if (acima.tipo == NO_LAZY) {
+            return {lazy_type[node], lazy[node]};
+        }
+        // ADD sobre ADD continua ADD, ADD sobre ASSIGN vira outro ASSIGN
+        return {lazy_type[node], lazy[node] + acima.valor};
+    }
+
+    // Valor real de um nó com 'len' elementos, dado o que está pendente acima dele
+    T aplica(Pendente acima, T valor, int len) const {
+        switch (acima.tipo) {
+            case LAZY_ADD: return somaIntervalo(valor, acima.valor, len);
+            case LAZY_ASSIGN: return valorIntervalo(acima.valor, len);
+            case NO_LAZY: break;
+        }
+        return valor;
+    }
+
+    T _query(int node, int L, int R, int l, int r, Pendente acima) const
     {
         //retorna valor padrão se for pra
         //fora dos limites
@@ -154,11 +244,17 @@ private:
         // Se o no contém o range buscado
         // retorna o valor desse no
         if (l <= L and R <= r) {
-            return tree[node];
+            return aplica(acima, tree[node], R - L + 1);
+        }
+
+        // Um assign pendente acima cobre a subárvore inteira:
+        // a resposta só depende de quantos elementos caem no range
+        if (acima.tipo == LAZY_ASSIGN) {
+            return valorIntervalo(acima.valor, std::min(R, r) - std::max(L, l) + 1);
         }
 
-        // Aplica lazy propagation antes de descer na árvore
-        push(node, L, R);
+        // Acumula a lazy do nó em vez de empurrar para os filhos
+        Pendente desce = compoe(acima, node);
 
         // Achar o elemento do meio para
         // dividir o vetor em duas metades
@@ -166,8 +262,145 @@ private:
 
         // Percorre recursivamente direita e 
         // esquerda e encontra o no
-        return operacao(_query(2 * node, L, mid, l, r), _query(2 * node + 1, mid + 1, R, l, r));
+        return operacao(_query(2 * node, L, mid, l, r, desce), _query(2 * node + 1, mid + 1, R, l, r, desce));
+    }
+
+    // Um nó (node, L, R) visitado por uma consulta
+    struct Frame {
+        int node, L, R;
+    };
+
+    // Etapas de uma consulta no modo intercalado. Um intervalo [l, r]
+    // desce por um único caminho até o nó onde se divide; dali em diante
+    // são só duas bordas: a esquerda, onde todo filho direito está contido,
+    // e a direita, onde todo filho esquerdo está contido.
+    enum Fase {
+        DESCE,      // ainda num caminho só, antes da divisão
+        ESQUERDA,   // borda esquerda: [l, R] do nó atual
+        DIREITA,    // borda direita: [L, r] do nó atual
+        FIM         // consulta terminada
+    };
+
+    // Estado de uma consulta em andamento no modo intercalado.
+    // Como cada etapa segue um caminho só, não há pilha: basta o nó atual,
+    // a lazy acumulada dos seus ancestrais e onde começa a borda direita.
+    struct Consulta {
+        int l, r;          // intervalo buscado
+        int idx;           // posição do resultado no vetor de saída
+        Fase fase;
+        T acc;             // resultado parcial
+        Frame atual;       // próximo nó a ser visitado
+        Pendente acima;    // lazy dos ancestrais de 'atual'
+        Frame direita;     // início da borda direita, guardado na divisão
+        Pendente acima_direita;
+    };
+
+    // Pede para a cache o que o próximo passo vai ler do nó. lazy[node]
+    // fica de fora: só é lido quando há tag, e buscá-lo sempre custaria
+    // uma linha (e uma página) a mais por nó, coisa que _query não paga.
+    // Só pode ser chamada para nós com filhos: numa folha 2 * node pode
+    // passar do fim de 'tree'. O teste fica em quem chama porque com um
+    // desvio aqui dentro o GCC deixa de expandir a função cedo, conclui
+    // que ela não tem efeito (o prefetch não conta) e apaga a chamada.
+    void _prefetch_no(int node) const {
+        SEGTREE_PREFETCH(&tree[2 * node]); // os dois filhos estão na mesma linha
+        SEGTREE_PREFETCH(&lazy_type[node]);
+    }
+
+    void _iniciar_consulta(Consulta& q, int idx, int l, int r) const {
+        q.l = l;
+        q.r = r;
+        q.idx = idx;
+        q.acc = valorPadrao();
+        q.fase = FIM;
+        if (l <= r and l <= size - 1 and 0 <= r) {
+            q.fase = DESCE;
+            q.atual = {1, 0, size - 1};
+            q.acima = {NO_LAZY, T()};
+        }
+    }
+
+    // Nó atual resolvido: passa para a borda direita ou termina
+    bool _fim_do_caminho(Consulta& q) const {
+        if (q.fase == ESQUERDA) {
+            q.fase = DIREITA;
+            q.atual = q.direita;
+            q.acima = q.acima_direita;
+            if (q.atual.L < q.atual.R) _prefetch_no(q.atual.node);
+            return true;
+        }
+        q.fase = FIM;
+        return false;
+    }
+
+    // Processa um único nó da consulta e devolve se ela ainda tem nós
+    // pendentes. Antes de devolver, pede o prefetch do próximo nó, assim
+    // a latência da memória fica escondida enquanto as outras consultas
+    // do lote avançam.
+    bool _passo(Consulta& q) const {
+        Frame f = q.atual;
+
+        // Nó totalmente contido: usa o valor direto
+        if (q.l <= f.L and f.R <= q.r) {
+            T valor = tree[f.node];
+            if (q.acima.tipo != NO_LAZY) valor = aplica(q.acima, valor, f.R - f.L + 1);
+            q.acc = operacao(q.acc, valor);
+            return _fim_do_caminho(q);
+        }
+
+        // Assign pendente cobre a subárvore inteira, não precisa descer
+        if (q.acima.tipo == LAZY_ASSIGN) {
+            int len = std::min(f.R, q.r) - std::max(f.L, q.l) + 1;
+            q.acc = operacao(q.acc, valorIntervalo(q.acima.valor, len));
+            return _fim_do_caminho(q);
+        }
+
+        // Acumula a lazy do nó em vez de empurrar para os filhos
+        Pendente desce = compoe(q.acima, f.node);
+
+        int mid = (f.L + f.R) / 2;
+
+        if (q.fase == DESCE) {
+            if (q.r <= mid) {
+                q.atual = {2 * f.node, f.L, mid};
+            } else if (q.l > mid) {
+                q.atual = {2 * f.node + 1, mid + 1, f.R};
+            } else {
+                // Divisão: segue pela borda esquerda e guarda a direita
+                q.fase = ESQUERDA;
+                q.direita = {2 * f.node + 1, mid + 1, f.R};
+                q.acima_direita = desce;
+                q.atual = {2 * f.node, f.L, mid};
+            }
+        } else {
+            // Nas bordas a escolha do lado é aleatória para o preditor de
+            // desvios, então é feita com aritmética sobre 0/1 em vez de
+            // if/else (o compilador transformava os ternários em saltos).
+            // Borda esquerda: se l <= mid o filho direito está contido e a
+            // busca segue pela esquerda; senão só segue pela direita.
+            // Borda direita: o mesmo, espelhado.
+            int esquerda = q.fase == ESQUERDA;
+            int pega = esquerda ? q.l <= mid : q.r > mid;
+            int lado = esquerda ^ pega;
+
+            // Filho contido: o direito na borda esquerda, o esquerdo na direita
+            int tam_esq = mid - f.L + 1;
+            int tam_contido = tam_esq + esquerda * (f.R - f.L + 1 - 2 * tam_esq);
+            T contido = tree[2 * f.node + esquerda];
+            if (desce.tipo != NO_LAZY) contido = aplica(desce, contido, tam_contido);
+            T opcoes[2] = {q.acc, operacao(q.acc, contido)};
+            q.acc = opcoes[pega];
+
+            q.atual.node = 2 * f.node + lado;
+            q.atual.L = f.L + lado * tam_esq;
+            q.atual.R = mid + lado * (f.R - mid);
+        }
+        q.acima = desce;
+
+        if (q.atual.L < q.atual.R) _prefetch_no(q.atual.node);
+        return true;
     }
+
     //daqui pra baixo tem os negocios de lazy propagation
     //não sei se eles vão estar funcionando, esse negócio
     //é uma loucura
@@ -176,13 +409,14 @@ private:
         if (marked[node]) {
             int mid = (L + R) / 2;
 
-            tree[node*2] = lazy[node] * (mid - L + 1);
-            tree[node*2+1] = lazy[node] * (R - mid);
+            tree[node*2] = valorIntervalo(lazy[node], mid - L + 1);
+            tree[node*2+1] = valorIntervalo(lazy[node], R - mid);
 
             lazy[node*2] = lazy[node*2+1] = lazy[node];
             marked[node*2] = marked[node*2+1] = true;
             lazy_type[node*2] = lazy_type[node*2+1] = LAZY_ASSIGN;
 
+            lazy[node] = 0;
             marked[node] = false;
             lazy_type[node] = NO_LAZY;
         }
@@ -192,8 +426,8 @@ private:
         if (lazy_type[node] == LAZY_ADD) {
             int mid = (L + R) / 2;
 
-            tree[node*2] += lazy[node] * (mid - L + 1);
-            tree[node*2+1] += lazy[node] * (R - mid);
+            tree[node*2] = somaIntervalo(tree[node*2], lazy[node], mid - L + 1);
+            tree[node*2+1] = somaIntervalo(tree[node*2+1], lazy[node], R - mid);
 
             if (lazy_type[node*2] == LAZY_ASSIGN) {
                 lazy[node*2] += lazy[node];  // ADD sobre ASSIGN existente
@@ -228,8 +462,10 @@ private:
     void _range_update_add(int node, int L, int R, int l, int r, T add) {
         if (l > r) return;
         
-        if (l == L && r == R) {
-            tree[node] += add * (R - L + 1);
+        if (L == R) {
+            tree[node] += add;
+        } else if (l == L && r == R && type != GCD) {
+            tree[node] = somaIntervalo(tree[node], add, R - L + 1);
 
             if (lazy_type[node] == LAZY_ASSIGN) {
                 // Se já tem ASSIGN pendente, ADD se aplica sobre o valor ASSIGN
@@ -245,7 +481,7 @@ private:
             int mid = (L + R) / 2;
             _range_update_add(node*2, L, mid, l, std::min(r, mid), add);
             _range_update_add(node*2+1, mid+1, R, std::max(l, mid+1), r, add);
-            tree[node] = tree[2*node] + tree[2*node+1];
+            tree[node] = operacao(tree[2*node], tree[2*node+1]);
         }
     }
 
@@ -253,7 +489,7 @@ private:
         if (l > r) return;
         
         if (l == L && R == r) {
-            tree[node] = new_val * (R - L + 1);
+            tree[node] = valorIntervalo(new_val, R - L + 1);
 
             lazy[node] = new_val;
             marked[node] = true;
@@ -263,7 +499,7 @@ private:
             int mid = (L + R) / 2;
             _range_update_assign(node*2, L, mid, l, std::min(r, mid), new_val);
             _range_update_assign(node*2+1, mid+1, R, std::max(l, mid+1), r, new_val);
-            tree[node] = tree[2*node] + tree[2*node+1];
+            tree[node] = operacao(tree[2*node], tree[2*node+1]);
         }
     }
 
@@ -289,9 +525,66 @@ public:
         _update_add(1, 0, size-1, pos, value);
     }; //atualiza a arvore somando'value' a algum valor
     
-    T query(int left, int right) {
-        return _query(1, 0, size-1, left, right);
-    }; //retorna a consulta entre left e right
+    T query(int left, int right) const {
+        // Intervalo invertido: sem isto o atalho do assign pendente em
+        // _query contaria um tamanho <= 0 e devolveria o valor da tag
+        if (left > right) return valorPadrao();
+        return _query(1, 0, size-1, left, right, {NO_LAZY, T()});
+    }; //retorna a consulta entre left e right (não modifica a árvore)
+
+    // Executa várias consultas independentes intercaladas: até 'width'
+    // consultas ficam ativas ao mesmo tempo e cada uma avança um nível
+    // por vez, em rodízio. Em árvores maiores que a cache isso permite
+    // que vários acessos à memória fiquem em andamento simultaneamente.
+    // O resultado i corresponde a query(ranges[i].first, ranges[i].second).
+    std::vector<T> queryBatch(const std::vector<std::pair<int, int>>& ranges, int width = 8) const {
+        std::vector<T> resultado(ranges.size());
+        if (ranges.empty()) return resultado;
+
+        width = std::max(1, std::min<int>(width, ranges.size()));
+
+        // Com uma consulta por vez não há o que intercalar: o prefetch não
+        // teria tempo de agir e só sobraria o custo da máquina de estados
+        if (width == 1) {
+            for (size_t i = 0; i < ranges.size(); i++) {
+                resultado[i] = query(ranges[i].first, ranges[i].second);
+            }
+            return resultado;
+        }
+
+        std::vector<Consulta> ativas(width);
+
+        // Preenche as posições iniciais do lote
+        int proxima = 0;
+        int em_andamento = 0;
+        for (int k = 0; k < width; k++) {
+            _iniciar_consulta(ativas[k], proxima, ranges[proxima].first, ranges[proxima].second);
+            proxima++;
+            em_andamento++;
+        }
+
+        while (em_andamento > 0) {
+            for (int k = 0; k < width; k++) {
+                Consulta& q = ativas[k];
+                if (q.idx < 0) continue; // posição já esvaziada
+
+                if (q.fase != FIM and _passo(q)) continue;
+
+                // Consulta terminou: guarda o resultado e, se houver,
+                // coloca a próxima consulta no lugar
+                resultado[q.idx] = q.acc;
+                if (proxima < (int)ranges.size()) {
+                    _iniciar_consulta(q, proxima, ranges[proxima].first, ranges[proxima].second);
+                    proxima++;
+                } else {
+                    q.idx = -1;
+                    em_andamento--;
+                }
+            }
+        }
+
+        return resultado;
+    }; //retorna query(l, r) para cada par em 'ranges', 'width' consultas por vez
     
     void rangeAdd(int left, int right, T value) {
         _range_update_add(1, 0, size-1, left, right, value);
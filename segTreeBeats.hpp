@@ -0,0 +1,276 @@
+/*
+ * Segment Tree Beats (Ji Ruyi driver)
+ *
+ * Além da soma em intervalo (rangeAdd), suporta:
+ * - rangeChmin(l, r, x): a[i] = min(a[i], x) para todo i em [l, r]
+ * - rangeChmax(l, r, x): a[i] = max(a[i], x) para todo i em [l, r]
+ * com consultas de soma, máximo e mínimo no intervalo.
+ *
+ * Cada nó guarda o maior valor, o segundo maior e quantas vezes o maior
+ * aparece (e o equivalente para o menor). Um chmin com max2 < x < max1
+ * só mexe nos elementos iguais ao máximo, então dá pra atualizar o nó
+ * inteiro sem descer. Quando isso não vale, a recursão continua; o custo
+ * amortizado fica em O(log² n) por operação.
+ *
+ * A soma usa o próprio tipo T: para valores grandes use long long.
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+template<typename T>
+class segTreeBeats
+{
+private:
+    struct No {
+        T soma;
+        T max1, max2; // maior e segundo maior valor (estritamente menor)
+        T min1, min2; // menor e segundo menor valor (estritamente maior)
+        int cmax;     // quantas vezes max1 aparece
+        int cmin;     // quantas vezes min1 aparece
+        T lazy;       // soma pendente para os filhos
+    };
+
+    int size; //tamanho do vetor usado pra construir a árvore
+    std::vector<No> tree;
+
+    static constexpr T MENOR = std::numeric_limits<T>::lowest(); // "não existe" para max2
+    static constexpr T MAIOR = std::numeric_limits<T>::max();    // "não existe" para min2
+
+    void folha(int node, T val) {
+        tree[node] = {val, val, MENOR, val, MAIOR, 1, 1, 0};
+    }
+
+    // Recalcula o nó a partir dos dois filhos
+    void junta(int node) {
+        No& a = tree[2 * node];
+        No& b = tree[2 * node + 1];
+        No& n = tree[node];
+
+        n.soma = a.soma + b.soma;
+
+        if (a.max1 == b.max1) {
+            n.max1 = a.max1;
+            n.cmax = a.cmax + b.cmax;
+            n.max2 = std::max(a.max2, b.max2);
+        } else if (a.max1 > b.max1) {
+            n.max1 = a.max1;
+            n.cmax = a.cmax;
+            n.max2 = std::max(a.max2, b.max1);
+        } else {
+            n.max1 = b.max1;
+            n.cmax = b.cmax;
+            n.max2 = std::max(a.max1, b.max2);
+        }
+
+        if (a.min1 == b.min1) {
+            n.min1 = a.min1;
+            n.cmin = a.cmin + b.cmin;
+            n.min2 = std::min(a.min2, b.min2);
+        } else if (a.min1 < b.min1) {
+            n.min1 = a.min1;
+            n.cmin = a.cmin;
+            n.min2 = std::min(a.min2, b.min1);
+        } else {
+            n.min1 = b.min1;
+            n.cmin = b.cmin;
+            n.min2 = std::min(a.min1, b.min2);
+        }
+    }
+
+    // Soma 'val' a todos os elementos do nó (que tem 'len' elementos)
+    void aplicaAdd(int node, int len, T val) {
+        No& n = tree[node];
+        n.soma += val * len;
+        n.max1 += val;
+        if (n.max2 != MENOR) n.max2 += val;
+        n.min1 += val;
+        if (n.min2 != MAIOR) n.min2 += val;
+        n.lazy += val;
+    }
+
+    // a[i] = min(a[i], x), supondo max2 < x: só o máximo muda
+    void aplicaMin(int node, T x) {
+        No& n = tree[node];
+        if (n.max1 <= x) return;
+
+        n.soma -= (n.max1 - x) * n.cmax;
+
+        // O máximo também pode ser o mínimo ou o segundo mínimo
+        if (n.min1 == n.max1) {
+            n.min1 = x;
+        } else if (n.min2 == n.max1) {
+            n.min2 = x;
+        }
+        n.max1 = x;
+    }
+
+    // a[i] = max(a[i], x), supondo min2 > x: só o mínimo muda
+    void aplicaMax(int node, T x) {
+        No& n = tree[node];
+        if (n.min1 >= x) return;
+
+        n.soma += (x - n.min1) * n.cmin;
+
+        if (n.max1 == n.min1) {
+            n.max1 = x;
+        } else if (n.max2 == n.min1) {
+            n.max2 = x;
+        }
+        n.min1 = x;
+    }
+
+    // Leva para os filhos a soma pendente e os chmin/chmax que só foram
+    // aplicados no nó (eles aparecem como max1/min1 do próprio nó)
+    void push(int node, int L, int R) {
+        int mid = (L + R) / 2;
+
+        if (tree[node].lazy != 0) {
+            aplicaAdd(2 * node, mid - L + 1, tree[node].lazy);
+            aplicaAdd(2 * node + 1, R - mid, tree[node].lazy);
+            tree[node].lazy = 0;
+        }
+
+        aplicaMin(2 * node, tree[node].max1);
+        aplicaMin(2 * node + 1, tree[node].max1);
+        aplicaMax(2 * node, tree[node].min1);
+        aplicaMax(2 * node + 1, tree[node].min1);
+    }
+
+    void build(const std::vector<T>& arr, int node, int L, int R)
+    {
+        if (L == R) {
+            folha(node, arr[L]);
+        }
+        else {
+            int mid = (L + R) / 2;
+            build(arr, 2 * node, L, mid);
+            build(arr, 2 * node + 1, mid + 1, R);
+            junta(node);
+        }
+    }
+
+    void _range_chmin(int node, int L, int R, int l, int r, T x) {
+        // Fora do intervalo ou nada a fazer
+        if (r < L or R < l or tree[node].max1 <= x) return;
+
+        // Só o máximo é afetado: atualiza o nó sem descer
+        if (l <= L and R <= r and tree[node].max2 < x) {
+            aplicaMin(node, x);
+            return;
+        }
+
+        // Folha: o atalho acima falha quando x == MENOR (max2 da folha já
+        // é MENOR), então o valor é trocado direto em vez de empurrar
+        if (L == R) {
+            folha(node, x);
+            return;
+        }
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        _range_chmin(2 * node, L, mid, l, r, x);
+        _range_chmin(2 * node + 1, mid + 1, R, l, r, x);
+        junta(node);
+    }
+
+    void _range_chmax(int node, int L, int R, int l, int r, T x) {
+        if (r < L or R < l or tree[node].min1 >= x) return;
+
+        if (l <= L and R <= r and tree[node].min2 > x) {
+            aplicaMax(node, x);
+            return;
+        }
+
+        // Folha com x == MAIOR: mesmo caso do chmin, espelhado
+        if (L == R) {
+            folha(node, x);
+            return;
+        }
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        _range_chmax(2 * node, L, mid, l, r, x);
+        _range_chmax(2 * node + 1, mid + 1, R, l, r, x);
+        junta(node);
+    }
+
+    void _range_add(int node, int L, int R, int l, int r, T val) {
+        if (r < L or R < l) return;
+
+        if (l <= L and R <= r) {
+            aplicaAdd(node, R - L + 1, val);
+            return;
+        }
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        _range_add(2 * node, L, mid, l, r, val);
+        _range_add(2 * node + 1, mid + 1, R, l, r, val);
+        junta(node);
+    }
+
+    T _query_sum(int node, int L, int R, int l, int r) {
+        if (r < L or R < l) return 0;
+        if (l <= L and R <= r) return tree[node].soma;
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        return _query_sum(2 * node, L, mid, l, r) + _query_sum(2 * node + 1, mid + 1, R, l, r);
+    }
+
+    T _query_max(int node, int L, int R, int l, int r) {
+        if (r < L or R < l) return MENOR;
+        if (l <= L and R <= r) return tree[node].max1;
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        return std::max(_query_max(2 * node, L, mid, l, r), _query_max(2 * node + 1, mid + 1, R, l, r));
+    }
+
+    T _query_min(int node, int L, int R, int l, int r) {
+        if (r < L or R < l) return MAIOR;
+        if (l <= L and R <= r) return tree[node].min1;
+
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        return std::min(_query_min(2 * node, L, mid, l, r), _query_min(2 * node + 1, mid + 1, R, l, r));
+    }
+
+public:
+    segTreeBeats(const std::vector<T>& arr) :
+        size(arr.size()),
+        tree(4 * arr.size())
+    {
+        build(arr, 1, 0, size - 1);
+    }; //construtor da classe
+
+    ~segTreeBeats() = default;
+
+    void rangeChmin(int left, int right, T x) {
+        _range_chmin(1, 0, size-1, left, right, x);
+    }; //troca cada elemento em [left, right] por min(elemento, x)
+
+    void rangeChmax(int left, int right, T x) {
+        _range_chmax(1, 0, size-1, left, right, x);
+    }; //troca cada elemento em [left, right] por max(elemento, x)
+
+    void rangeAdd(int left, int right, T value) {
+        _range_add(1, 0, size-1, left, right, value);
+    }; //soma 'value' a todos os elementos no intervalo [left, right]
+
+    T querySum(int left, int right) {
+        return _query_sum(1, 0, size-1, left, right);
+    }; //retorna a soma entre left e right
+
+    T queryMax(int left, int right) {
+        return _query_max(1, 0, size-1, left, right);
+    }; //retorna o maior elemento entre left e right
+
+    T queryMin(int left, int right) {
+        return _query_min(1, 0, size-1, left, right);
+    }; //retorna o menor elemento entre left e right
+};
@@ -0,0 +1,266 @@
+#include "segTreeBeats.hpp"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <array>
+#include <limits>
+
+class TestFramework {
+private:
+    unsigned seed;
+    std::mt19937 gen;
+
+public:
+    TestFramework() : seed(std::random_device{}()), gen(seed) {
+        std::cout << "🎲 seed: " << seed << "\n\n";
+    }
+
+    // Implementação naive usando vetores normais
+    class NaiveBeats {
+    private:
+        std::vector<long long> arr;
+
+    public:
+        NaiveBeats(const std::vector<long long>& initial) : arr(initial) {}
+
+        void rangeChmin(int l, int r, long long x) {
+            for (int i = l; i <= r; i++) arr[i] = std::min(arr[i], x);
+        }
+
+        void rangeChmax(int l, int r, long long x) {
+            for (int i = l; i <= r; i++) arr[i] = std::max(arr[i], x);
+        }
+
+        void rangeAdd(int l, int r, long long val) {
+            for (int i = l; i <= r; i++) arr[i] += val;
+        }
+
+        long long querySum(int l, int r) {
+            return std::accumulate(arr.begin() + l, arr.begin() + r + 1, 0LL);
+        }
+
+        long long queryMax(int l, int r) {
+            return *std::max_element(arr.begin() + l, arr.begin() + r + 1);
+        }
+
+        long long queryMin(int l, int r) {
+            return *std::min_element(arr.begin() + l, arr.begin() + r + 1);
+        }
+
+        void print() {
+            std::cout << "Array: ";
+            for (long long x : arr) std::cout << x << " ";
+            std::cout << std::endl;
+        }
+    };
+
+    // Compara as três consultas em todos os intervalos
+    void verificaTudo(segTreeBeats<long long>& tree, NaiveBeats& naive, int n, const char* onde) {
+        for (int l = 0; l < n; l++) {
+            for (int r = l; r < n; r++) {
+                if (tree.querySum(l, r) != naive.querySum(l, r) or
+                    tree.queryMax(l, r) != naive.queryMax(l, r) or
+                    tree.queryMin(l, r) != naive.queryMin(l, r)) {
+                    std::cout << "❌ ERRO " << onde << ": intervalo (" << l << "," << r << ") sum="
+                              << tree.querySum(l, r) << "/" << naive.querySum(l, r) << " max="
+                              << tree.queryMax(l, r) << "/" << naive.queryMax(l, r) << " min="
+                              << tree.queryMin(l, r) << "/" << naive.queryMin(l, r) << std::endl;
+                    naive.print();
+                    assert(false);
+                }
+            }
+        }
+    }
+
+    void testBasico() {
+        std::cout << "🧪 Testando chmin/chmax básicos...\n";
+
+        std::vector<long long> arr = {5, 1, 9, 3, 7, 7, 2, 8};
+        segTreeBeats<long long> tree(arr);
+        NaiveBeats naive(arr);
+
+        tree.rangeChmin(0, 7, 6);
+        naive.rangeChmin(0, 7, 6);
+        verificaTudo(tree, naive, arr.size(), "chmin");
+
+        tree.rangeChmax(2, 5, 4);
+        naive.rangeChmax(2, 5, 4);
+        verificaTudo(tree, naive, arr.size(), "chmax");
+
+        tree.rangeAdd(1, 6, -3);
+        naive.rangeAdd(1, 6, -3);
+        verificaTudo(tree, naive, arr.size(), "add");
+
+        tree.rangeChmin(0, 3, 0);
+        naive.rangeChmin(0, 3, 0);
+        verificaTudo(tree, naive, arr.size(), "chmin negativo");
+
+        std::cout << "✅ chmin/chmax básicos funcionando!\n";
+    }
+
+    // chmin com lowest() e chmax com max(): o atalho do nó nunca vale
+    // e a recursão chega até a folha. Os outros valores ficam em 0 para
+    // as somas não estourarem.
+    void testExtremos() {
+        std::cout << "🧪 Testando chmin/chmax com os valores extremos...\n";
+
+        const long long MENOR = std::numeric_limits<long long>::lowest();
+        const long long MAIOR = std::numeric_limits<long long>::max();
+
+        std::vector<long long> arr = {0, 3, 0};
+        segTreeBeats<long long> tree(arr);
+        NaiveBeats naive(arr);
+
+        tree.rangeChmin(1, 1, MENOR);
+        naive.rangeChmin(1, 1, MENOR);
+        verificaTudo(tree, naive, arr.size(), "chmin lowest()");
+
+        tree.rangeChmax(1, 1, MAIOR);
+        naive.rangeChmax(1, 1, MAIOR);
+        verificaTudo(tree, naive, arr.size(), "chmax max()");
+
+        // Árvore de um elemento só: a raiz já é a folha
+        std::vector<long long> um = {4};
+        segTreeBeats<long long> unica(um);
+        NaiveBeats naive_unica(um);
+
+        unica.rangeChmin(0, 0, MENOR);
+        naive_unica.rangeChmin(0, 0, MENOR);
+        verificaTudo(unica, naive_unica, 1, "chmin lowest() n = 1");
+
+        unica.rangeChmax(0, 0, MAIOR);
+        naive_unica.rangeChmax(0, 0, MAIOR);
+        verificaTudo(unica, naive_unica, 1, "chmax max() n = 1");
+
+        std::cout << "✅ Valores extremos funcionando!\n";
+    }
+
+    // Operações aleatórias em vários tamanhos, inclusive 1 e
+    // não potências de 2
+    void testDiferencial() {
+        std::cout << "🧪 Teste diferencial contra o naive...\n";
+
+        for (int n : {1, 2, 3, 5, 8, 13, 31, 64}) {
+            std::uniform_int_distribution<long long> val_dist(-100, 100);
+            std::vector<long long> arr(n);
+            for (auto& x : arr) x = val_dist(gen);
+
+            segTreeBeats<long long> tree(arr);
+            NaiveBeats naive(arr);
+
+            std::uniform_int_distribution<int> op_dist(0, 3);
+            std::uniform_int_distribution<int> pos_dist(0, n - 1);
+
+            for (int test = 0; test < 2000; test++) {
+                int l = pos_dist(gen), r = pos_dist(gen);
+                if (l > r) std::swap(l, r);
+                long long val = val_dist(gen);
+
+                switch (op_dist(gen)) {
+                    case 0:
+                        tree.rangeChmin(l, r, val);
+                        naive.rangeChmin(l, r, val);
+                        break;
+                    case 1:
+                        tree.rangeChmax(l, r, val);
+                        naive.rangeChmax(l, r, val);
+                        break;
+                    case 2:
+                        tree.rangeAdd(l, r, val / 4);
+                        naive.rangeAdd(l, r, val / 4);
+                        break;
+                    case 3:
+                        if (tree.querySum(l, r) != naive.querySum(l, r) or
+                            tree.queryMax(l, r) != naive.queryMax(l, r) or
+                            tree.queryMin(l, r) != naive.queryMin(l, r)) {
+                            std::cout << "❌ ERRO no teste " << test << " (n = " << n << ", seed = "
+                                      << seed << "): intervalo (" << l << "," << r << ")\n";
+                            naive.print();
+                            assert(false);
+                        }
+                        break;
+                }
+            }
+
+            verificaTudo(tree, naive, n, "final");
+        }
+
+        std::cout << "✅ Teste diferencial passou!\n";
+    }
+
+    // Benchmark de performance
+    void benchmarkPerformance() {
+        std::cout << "⚡ Benchmark de Performance...\n";
+
+        const int n = 20000;
+        const int operations = 20000;
+        std::uniform_int_distribution<long long> val_dist(0, 1000000000);
+        std::uniform_int_distribution<int> pos_dist(0, n - 1);
+
+        std::vector<long long> arr(n);
+        for (auto& x : arr) x = val_dist(gen);
+
+        segTreeBeats<long long> tree(arr);
+        NaiveBeats naive(arr);
+
+        std::vector<std::array<long long, 4>> ops(operations);
+        for (auto& op : ops) {
+            int l = pos_dist(gen), r = pos_dist(gen);
+            if (l > r) std::swap(l, r);
+            op = {(long long)(gen() % 4), l, r, val_dist(gen)};
+        }
+
+        auto roda = [&](auto& t) {
+            long long checksum = 0;
+            for (auto& [tipo, l, r, val] : ops) {
+                switch (tipo) {
+                    case 0: t.rangeChmin(l, r, val); break;
+                    case 1: t.rangeChmax(l, r, val); break;
+                    case 2: t.rangeAdd(l, r, val % 1000 - 500); break;
+                    case 3: checksum += t.querySum(l, r); break;
+                }
+            }
+            return checksum;
+        };
+
+        auto start = std::chrono::high_resolution_clock::now();
+        long long seg_checksum = roda(tree);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto seg_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        start = std::chrono::high_resolution_clock::now();
+        long long naive_checksum = roda(naive);
+        end = std::chrono::high_resolution_clock::now();
+        auto naive_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        assert(seg_checksum == naive_checksum);
+
+        std::cout << "🚀 Segment Tree Beats: " << seg_time.count() << "ms\n";
+        std::cout << "🐌 Implementação Naive: " << naive_time.count() << "ms\n";
+        std::cout << "📈 Speedup: " << (double)naive_time.count() / std::max<long long>(1, seg_time.count()) << "x\n";
+    }
+};
+
+int main() {
+    std::cout << "🌳 === TESTE DA SEGMENT TREE BEATS ===\n\n";
+
+    TestFramework tester;
+
+    tester.testBasico();
+    std::cout << std::endl;
+
+    tester.testExtremos();
+    std::cout << std::endl;
+
+    tester.testDiferencial();
+    std::cout << std::endl;
+
+    tester.benchmarkPerformance();
+
+    std::cout << "\n🎉 TODOS OS TESTES PASSARAM!\n";
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * Segment Tree fatiada (sharded) para uso com várias threads
+ *
+ * O intervalo [0, n-1] é dividido em P fatias contíguas, cada uma com a
+ * sua própria segTree e o seu próprio mutex. Atualizações em fatias
+ * diferentes andam em paralelo, e como segTree::query é const, consultas
+ * na mesma fatia também (a trava é compartilhada para leitura). Uma
+ * árvore pequena no topo guarda o resultado de cada fatia inteira, assim
+ * consultas longas só precisam descer nas duas fatias das pontas.
+ *
+ * Consistência: cada operação é atômica dentro de uma fatia. Uma consulta
+ * (ou range update) que cruza várias fatias não é um snapshot único: ela
+ * pode ver atualizações concorrentes em algumas fatias e não em outras.
+ *
+ * Intervalos: query, rangeAdd e rangeAssign limitam [left, right] a
+ * [0, n-1] antes de escolher as fatias (como a segTree, que ignora o que
+ * cai fora); um intervalo que fica vazio não faz nada. assign e add
+ * exigem 0 <= pos < n.
+ */
+
+#pragma once
+
+#include "segTree.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <atomic>
+
+template<typename T>
+class segTreeSharded
+{
+private:
+    struct Fatia {
+        std::shared_mutex trava;  // protege 'arvore' e 'agregado'; consultas só leem
+        segTree<T> arvore;        // árvore local das posições [inicio, fim]
+        int inicio, fim;
+        T agregado;               // query(0, fim-inicio) da árvore local
+        std::atomic<bool> sujo;   // 'agregado' mudou e o topo ainda não viu
+
+        Fatia(const std::vector<T>& arr, TreeType type, int inicio, int fim) :
+            arvore(arr, type),
+            inicio(inicio),
+            fim(fim),
+            agregado(arvore.query(0, fim - inicio)),
+            sujo(false) {}
+    };
+
+    TreeType type; //controla se é uma arvore de min,max, sum ou gcd
+    int size; //tamanho do vetor usado pra construir a árvore
+    int tam_fatia; //tamanho de cada fatia (a última pode ser menor)
+    std::vector<std::unique_ptr<Fatia>> fatias;
+
+    std::mutex trava_topo;    // protege 'topo'
+    segTree<T> topo;          // árvore sobre os agregados das fatias
+
+    T operacao(T a, T b) {
+      return operacaoDoTipo(type, a, b);
+    }
+
+    T valorPadrao() {
+      return valorPadraoDoTipo<T>(type);
+    }
+
+    static std::vector<T> agregados(const std::vector<std::unique_ptr<Fatia>>& fatias) {
+        std::vector<T> res;
+        res.reserve(fatias.size());
+        for (auto& f : fatias) res.push_back(f->agregado);
+        return res;
+    }
+
+    // 'pos' precisa estar em [0, size-1], senão a fatia não existe
+    int fatiaDe(int pos) {
+        return pos / tam_fatia;
+    }
+
+    // Deve ser chamada com a trava da fatia já adquirida.
+    // O topo não é tocado aqui: só marca a fatia como suja, assim
+    // atualizações em fatias diferentes nunca disputam a mesma trava.
+    void atualizaAgregado(Fatia& f) {
+        f.agregado = f.arvore.query(0, f.fim - f.inicio);
+        f.sujo.store(true, std::memory_order_release);
+    }
+
+    // Copia para o topo os agregados das fatias [a, b] que mudaram.
+    // Deve ser chamada com a trava do topo já adquirida.
+    void sincronizaTopo(int a, int b) {
+        for (int i = a; i <= b; i++) {
+            Fatia& f = *fatias[i];
+            if (!f.sujo.load(std::memory_order_acquire)) continue;
+
+            std::shared_lock<std::shared_mutex> lock(f.trava);
+            f.sujo.store(false, std::memory_order_relaxed);
+            topo.assign(i, f.agregado);
+        }
+    }
+
+    // Aplica 'op' na parte de [left, right] que cai em cada fatia,
+    // uma fatia por vez, em ordem crescente
+    template<typename Op>
+    void paraCadaFatia(int left, int right, Op op) {
+        left = std::max(left, 0);
+        right = std::min(right, size - 1);
+        if (left > right) return; // nada a fazer: não trava nem suja fatia
+
+        for (int i = fatiaDe(left); i <= fatiaDe(right); i++) {
+            Fatia& f = *fatias[i];
+            int l = std::max(left, f.inicio) - f.inicio;
+            int r = std::min(right, f.fim) - f.inicio;
+
+            std::lock_guard<std::shared_mutex> lock(f.trava);
+            op(f.arvore, l, r);
+            atualizaAgregado(f);
+        }
+    }
+
+    static int calculaTamFatia(int n, int shards) {
+        shards = std::max(1, std::min(shards, n));
+        return (n + shards - 1) / shards;
+    }
+
+    static std::vector<std::unique_ptr<Fatia>> criaFatias(const std::vector<T>& arr, TreeType type, int tam_fatia) {
+        std::vector<std::unique_ptr<Fatia>> res;
+        for (int inicio = 0; inicio < (int)arr.size(); inicio += tam_fatia) {
+            int fim = std::min<int>(inicio + tam_fatia, arr.size()) - 1;
+            std::vector<T> parte(arr.begin() + inicio, arr.begin() + fim + 1);
+            res.push_back(std::make_unique<Fatia>(parte, type, inicio, fim));
+        }
+        return res;
+    }
+
+public:
+    // 'shards' é o número desejado de fatias (P), normalmente o número
+    // de núcleos. É limitado a [1, arr.size()].
+    segTreeSharded(const std::vector<T>& arr, TreeType type, int shards) :
+        type(type),
+        size(arr.size()),
+        tam_fatia(calculaTamFatia(arr.size(), shards)),
+        fatias(criaFatias(arr, type, tam_fatia)),
+        topo(agregados(fatias), type)
+    {
+    }; //construtor da classe
+
+    ~segTreeSharded() = default;
+
+    int shards() const {
+        return fatias.size();
+    }; //número de fatias efetivamente criadas
+
+    void assign(int pos, T value) {
+        Fatia& f = *fatias[fatiaDe(pos)];
+        std::lock_guard<std::shared_mutex> lock(f.trava);
+        f.arvore.assign(pos - f.inicio, value);
+        atualizaAgregado(f);
+    }; //atualiza a arvore trocando um dos valores por 'value'
+
+    void add(int pos, T value) {
+        Fatia& f = *fatias[fatiaDe(pos)];
+        std::lock_guard<std::shared_mutex> lock(f.trava);
+        f.arvore.add(pos - f.inicio, value);
+        atualizaAgregado(f);
+    }; //atualiza a arvore somando'value' a algum valor
+
+    void rangeAdd(int left, int right, T value) {
+        paraCadaFatia(left, right, [value](segTree<T>& t, int l, int r) {
+            t.rangeAdd(l, r, value);
+        });
+    }; //soma 'value' a todos os elementos no intervalo [left, right]
+
+    void rangeAssign(int left, int right, T value) {
+        paraCadaFatia(left, right, [value](segTree<T>& t, int l, int r) {
+            t.rangeAssign(l, r, value);
+        });
+    }; //atribui 'value' a todos os elementos no intervalo [left, right]
+
+    T query(int left, int right) {
+        left = std::max(left, 0);
+        right = std::min(right, size - 1);
+        if (left > right) return valorPadrao();
+
+        int a = fatiaDe(left);
+        int b = fatiaDe(right);
+
+        // Intervalo dentro de uma única fatia: só ela é travada
+        if (a == b) {
+            Fatia& f = *fatias[a];
+            std::shared_lock<std::shared_mutex> lock(f.trava);
+            return f.arvore.query(left - f.inicio, right - f.inicio);
+        }
+
+        T res = valorPadrao();
+
+        // Ponta esquerda, parcial
+        {
+            Fatia& f = *fatias[a];
+            std::shared_lock<std::shared_mutex> lock(f.trava);
+            res = operacao(res, f.arvore.query(left - f.inicio, f.fim - f.inicio));
+        }
+
+        // Fatias inteiras do meio: resolvidas pela árvore do topo
+        if (a + 1 <= b - 1) {
+            std::lock_guard<std::mutex> lock(trava_topo);
+            sincronizaTopo(a + 1, b - 1);
+            res = operacao(res, topo.query(a + 1, b - 1));
+        }
+
+        // Ponta direita, parcial
+        {
+            Fatia& f = *fatias[b];
+            std::shared_lock<std::shared_mutex> lock(f.trava);
+            res = operacao(res, f.arvore.query(0, right - f.inicio));
+        }
+
+        return res;
+    }; //retorna a consulta entre left e right
+};
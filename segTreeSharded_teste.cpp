@@ -0,0 +1,211 @@
+#include "segTreeSharded.hpp"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <thread>
+#include <cstdlib>
+
+// Referência naive: vetor simples, query linear
+int naiveQuery(const std::vector<int>& arr, TreeType type, int l, int r) {
+    int result = arr[l];
+    for (int i = l + 1; i <= r; i++) {
+        switch (type) {
+            case SUM: result += arr[i]; break;
+            case MAX: result = std::max(result, arr[i]); break;
+            case MIN: result = std::min(result, arr[i]); break;
+            case GCD: result = std::gcd(result, arr[i]); break;
+        }
+    }
+    return result;
+}
+
+// Operações pontuais em uma thread só, todos os tipos e vários P
+void testPontual(std::mt19937& gen) {
+    std::cout << "🧪 Testando operações pontuais contra o naive...\n";
+
+    for (int n : {1, 2, 7, 64, 100}) {
+        for (int shards : {1, 2, 3, 8, 200}) {
+            for (TreeType type : {SUM, MAX, MIN, GCD}) {
+                std::uniform_int_distribution<int> val_dist(1, 100);
+                std::vector<int> arr(n);
+                for (auto& x : arr) x = val_dist(gen);
+
+                segTreeSharded<int> tree(arr, type, shards);
+                assert(tree.shards() >= 1 and tree.shards() <= std::min(n, shards));
+
+                std::uniform_int_distribution<int> pos_dist(0, n - 1);
+                for (int op = 0; op < 500; op++) {
+                    int l = pos_dist(gen), r = pos_dist(gen);
+                    if (l > r) std::swap(l, r);
+                    int val = val_dist(gen);
+
+                    if (op % 3 == 0) {
+                        tree.assign(l, val);
+                        arr[l] = val;
+                    } else if (op % 3 == 1) {
+                        tree.add(l, val);
+                        arr[l] += val;
+                    } else {
+                        int seg_result = tree.query(l, r);
+                        int naive_result = naiveQuery(arr, type, l, r);
+                        if (seg_result != naive_result) {
+                            std::cout << "❌ ERRO: n=" << n << " P=" << shards << " query(" << l << "," << r
+                                      << ") seg=" << seg_result << " naive=" << naive_result << std::endl;
+                            assert(false);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << "✅ Operações pontuais funcionando!\n";
+}
+
+// Range updates cruzando fatias (só SUM, como em segTree_lazy_teste)
+void testRange(std::mt19937& gen) {
+    std::cout << "🧪 Testando range updates entre fatias...\n";
+
+    const int n = 50;
+    std::vector<int> arr(n, 1);
+    segTreeSharded<int> tree(arr, SUM, 6);
+
+    std::uniform_int_distribution<int> pos_dist(0, n - 1);
+    std::uniform_int_distribution<int> val_dist(-20, 20);
+    for (int op = 0; op < 2000; op++) {
+        int l = pos_dist(gen), r = pos_dist(gen);
+        if (l > r) std::swap(l, r);
+        int val = val_dist(gen);
+
+        if (op % 3 == 0) {
+            tree.rangeAdd(l, r, val);
+            for (int i = l; i <= r; i++) arr[i] += val;
+        } else if (op % 3 == 1) {
+            tree.rangeAssign(l, r, val);
+            for (int i = l; i <= r; i++) arr[i] = val;
+        } else {
+            assert(tree.query(l, r) == naiveQuery(arr, SUM, l, r));
+        }
+    }
+
+    // Intervalos que passam das pontas são limitados a [0, n-1]
+    tree.rangeAdd(n - 3, n + 100, 5);
+    for (int i = n - 3; i < n; i++) arr[i] += 5;
+    tree.rangeAssign(-10, 2, 7);
+    for (int i = 0; i <= 2; i++) arr[i] = 7;
+    assert(tree.query(-5, n + 5) == naiveQuery(arr, SUM, 0, n - 1));
+    assert(tree.query(n - 2, 1 << 30) == naiveQuery(arr, SUM, n - 2, n - 1));
+    assert(tree.query(n, n + 3) == 0);
+
+    // Intervalos vazios depois de limitados (invertidos ou todo fora) não mudam nada
+    tree.rangeAdd(5, 3, 100);
+    tree.rangeAssign(-4, -1, 9);
+    tree.rangeAdd(n, n + 5, 1);
+    assert(tree.query(0, n - 1) == naiveQuery(arr, SUM, 0, n - 1));
+
+    std::cout << "✅ Range updates funcionando!\n";
+}
+
+// Várias threads somando em posições aleatórias; no fim a soma total
+// tem que bater com o total de incrementos feitos
+void testConcorrente() {
+    std::cout << "🧪 Testando atualizações concorrentes...\n";
+
+    const int n = 1000, threads = 4, ops = 20000;
+    std::vector<int> arr(n, 0);
+    segTreeSharded<int> tree(arr, SUM, threads);
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&tree, t]() {
+            std::mt19937 gen(t);
+            std::uniform_int_distribution<int> pos_dist(0, n - 1);
+            for (int i = 0; i < ops; i++) {
+                tree.add(pos_dist(gen), 1);
+                if (i % 64 == 0) tree.query(0, n - 1);
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    assert(tree.query(0, n - 1) == threads * ops);
+
+    std::cout << "✅ Atualizações concorrentes funcionando!\n";
+}
+
+// Vazão de atualizações pontuais: uma segTree com um mutex global
+// contra a versão fatiada com P = número de threads
+void benchmarkEscala(int n, int ops_por_thread) {
+    std::cout << "⚡ Benchmark de atualizações (n = " << n << ", "
+              << ops_por_thread << " ops por thread, 1 query a cada 16)...\n";
+
+    std::vector<int> arr(n, 1);
+    int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int threads = 1; threads <= std::max(8, max_threads); threads *= 2) {
+        auto roda = [&](auto&& update, auto&& query) {
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> pool;
+            for (int t = 0; t < threads; t++) {
+                pool.emplace_back([&, t]() {
+                    std::mt19937 gen(t);
+                    std::uniform_int_distribution<int> pos_dist(0, n - 1);
+                    for (int i = 0; i < ops_por_thread; i++) {
+                        int pos = pos_dist(gen);
+                        if (i % 16 == 0) {
+                            int outro = pos_dist(gen);
+                            query(std::min(pos, outro), std::max(pos, outro));
+                        } else {
+                            update(pos);
+                        }
+                    }
+                });
+            }
+            for (auto& th : pool) th.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        };
+
+        segTree<int> unica(arr, SUM);
+        std::mutex trava;
+        double unica_ms = roda(
+            [&](int pos) { std::lock_guard<std::mutex> lock(trava); unica.add(pos, 1); },
+            [&](int l, int r) { std::lock_guard<std::mutex> lock(trava); return unica.query(l, r); });
+
+        segTreeSharded<int> fatiada(arr, SUM, threads * 4);
+        double fatiada_ms = roda(
+            [&](int pos) { fatiada.add(pos, 1); },
+            [&](int l, int r) { return fatiada.query(l, r); });
+
+        double total = (double)threads * ops_por_thread;
+        std::cout << "   " << threads << " thread(s): mutex global " << total / unica_ms / 1000.0
+                  << " Mops/s | fatiada (P = " << fatiada.shards() << ") "
+                  << total / fatiada_ms / 1000.0 << " Mops/s\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    std::cout << "🌳 === TESTE DA SEGMENT TREE FATIADA ===\n\n";
+
+    // uso: ./SegTreeSharded [n] [ops por thread]
+    int n = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+    int ops = argc > 2 ? std::atoi(argv[2]) : 1 << 19;
+
+    std::mt19937 gen(std::random_device{}());
+
+    testPontual(gen);
+    std::cout << std::endl;
+
+    testRange(gen);
+    std::cout << std::endl;
+
+    testConcorrente();
+    std::cout << std::endl;
+
+    benchmarkEscala(n, ops);
+
+    std::cout << "\n🎉 TODOS OS TESTES PASSARAM!\n";
+    return 0;
+}
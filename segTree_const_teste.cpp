@@ -0,0 +1,237 @@
+#include "segTree.hpp"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <thread>
+#include <mutex>
+#include <cstdlib>
+
+// Só compila se query() puder ser chamada por uma referência const
+int consultaConst(const segTree<int>& tree, int l, int r) {
+    return tree.query(l, r);
+}
+
+// Consultas const com muitas lazy pendentes (nenhuma é empurrada, já
+// que query não escreve mais na árvore) contra um vetor simples
+void testConstComLazy(std::mt19937& gen) {
+    std::cout << "🧪 Testando query() const com lazy pendente...\n";
+
+    for (TreeType type : {SUM, MAX, MIN, GCD}) {
+        const int n = 37;
+        std::uniform_int_distribution<int> val_dist(0, 100);
+        std::vector<int> arr(n);
+        for (auto& x : arr) x = val_dist(gen);
+
+        segTree<int> tree(arr, type);
+        std::uniform_int_distribution<int> pos_dist(0, n - 1);
+
+        for (int op = 0; op < 300; op++) {
+            int l = pos_dist(gen), r = pos_dist(gen);
+            if (l > r) std::swap(l, r);
+            int val = val_dist(gen);
+
+            if (op % 2) {
+                tree.rangeAdd(l, r, val);
+                for (int i = l; i <= r; i++) arr[i] += val;
+            } else {
+                tree.rangeAssign(l, r, val);
+                for (int i = l; i <= r; i++) arr[i] = val;
+            }
+
+            // Duas rodadas: se a consulta mudasse a árvore, a segunda
+            // poderia dar diferente da primeira
+            for (int rodada = 0; rodada < 2; rodada++) {
+                for (int a = 0; a < n; a++) {
+                    int esperado = arr[a];
+                    for (int b = a; b < n; b++) {
+                        if (b > a) {
+                            switch (type) {
+                                case SUM: esperado += arr[b]; break;
+                                case MAX: esperado = std::max(esperado, arr[b]); break;
+                                case MIN: esperado = std::min(esperado, arr[b]); break;
+                                case GCD: esperado = std::gcd(esperado, arr[b]); break;
+                            }
+                        }
+                        assert(consultaConst(tree, a, b) == esperado);
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << "✅ query() const funcionando!\n";
+}
+
+// Referência do caminho antigo, só para o benchmark: árvore de soma com
+// lazy em que a consulta empurra as tags para os filhos (escrevendo na
+// árvore), como segTree::_query fazia antes de ser const
+class ArvoreEmpurra {
+private:
+    enum Tag { NADA, SOMA, TROCA };
+
+    int n;
+    std::vector<int> soma;
+    std::vector<int> valor; // valor da tag pendente
+    std::vector<Tag> tag;
+
+    void build(const std::vector<int>& arr, int node, int L, int R) {
+        if (L == R) {
+            soma[node] = arr[L];
+            return;
+        }
+        int mid = (L + R) / 2;
+        build(arr, 2 * node, L, mid);
+        build(arr, 2 * node + 1, mid + 1, R);
+        soma[node] = soma[2 * node] + soma[2 * node + 1];
+    }
+
+    // Aplica uma operação no nó inteiro e guarda a tag para os filhos
+    void marca(int node, int len, Tag t, int v) {
+        if (t == TROCA) {
+            soma[node] = v * len;
+            valor[node] = v;
+            tag[node] = TROCA;
+        } else {
+            soma[node] += v * len;
+            valor[node] = tag[node] == NADA ? v : valor[node] + v;
+            if (tag[node] == NADA) tag[node] = SOMA;
+        }
+    }
+
+    void push(int node, int L, int R) {
+        if (tag[node] == NADA) return;
+        int mid = (L + R) / 2;
+        marca(2 * node, mid - L + 1, tag[node], valor[node]);
+        marca(2 * node + 1, R - mid, tag[node], valor[node]);
+        tag[node] = NADA;
+        valor[node] = 0;
+    }
+
+    void _update(int node, int L, int R, int l, int r, Tag t, int v) {
+        if (r < L or R < l) return;
+        if (l <= L and R <= r) {
+            marca(node, R - L + 1, t, v);
+            return;
+        }
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        _update(2 * node, L, mid, l, r, t, v);
+        _update(2 * node + 1, mid + 1, R, l, r, t, v);
+        soma[node] = soma[2 * node] + soma[2 * node + 1];
+    }
+
+    int _query(int node, int L, int R, int l, int r) {
+        if (r < L or R < l) return 0;
+        if (l <= L and R <= r) return soma[node];
+        push(node, L, R);
+        int mid = (L + R) / 2;
+        return _query(2 * node, L, mid, l, r) + _query(2 * node + 1, mid + 1, R, l, r);
+    }
+
+public:
+    ArvoreEmpurra(const std::vector<int>& arr) :
+        n(arr.size()), soma(4 * arr.size()), valor(4 * arr.size()), tag(4 * arr.size(), NADA)
+    {
+        build(arr, 1, 0, n - 1);
+    }
+
+    void rangeAdd(int l, int r, int v) { _update(1, 0, n - 1, l, r, SOMA, v); }
+    void rangeAssign(int l, int r, int v) { _update(1, 0, n - 1, l, r, TROCA, v); }
+    int query(int l, int r) { return _query(1, 0, n - 1, l, r); }
+};
+
+// Várias threads consultando a mesma árvore. No caminho antigo a consulta
+// empurra a lazy, então as threads leitoras precisam de uma trava
+// exclusiva; no caminho const a árvore é só lida e não há trava nenhuma.
+void benchmarkLeituraConcorrente(std::mt19937& gen, int n, int consultas_por_thread) {
+    std::cout << "⚡ Benchmark de leituras concorrentes (n = " << n << ", "
+              << consultas_por_thread << " consultas por thread)...\n";
+
+    std::vector<int> arr(n, 1);
+    segTree<int> tree(arr, SUM);
+    ArvoreEmpurra original(arr);
+
+    // Deixa muitas tags pendentes espalhadas pela árvore
+    std::uniform_int_distribution<int> pos_dist(0, n - 1);
+    for (int i = 0; i < n / 8; i++) {
+        int l = pos_dist(gen), r = pos_dist(gen);
+        if (l > r) std::swap(l, r);
+        if (i % 2) {
+            tree.rangeAdd(l, r, 1);
+            original.rangeAdd(l, r, 1);
+        } else {
+            tree.rangeAssign(l, r, 2);
+            original.rangeAssign(l, r, 2);
+        }
+    }
+    const segTree<int>& leitura = tree;
+
+    int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int threads = 1; threads <= std::max(8, max_threads); threads *= 2) {
+        auto roda = [&](auto&& consulta) {
+            std::vector<long long> soma(threads);
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> pool;
+            for (int t = 0; t < threads; t++) {
+                pool.emplace_back([&, t]() {
+                    std::mt19937 g(t);
+                    std::uniform_int_distribution<int> d(0, n - 1);
+                    long long local = 0;
+                    for (int i = 0; i < consultas_por_thread; i++) {
+                        int l = d(g), r = d(g);
+                        if (l > r) std::swap(l, r);
+                        local += consulta(l, r);
+                    }
+                    soma[t] = local;
+                });
+            }
+            for (auto& th : pool) th.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::make_pair(std::chrono::duration<double, std::milli>(end - start).count(), soma);
+        };
+
+        // Caminho antigo: push durante a consulta, uma thread por vez.
+        // Cada rodada começa de uma cópia com todas as tags ainda pendentes.
+        ArvoreEmpurra empurra = original;
+        std::mutex trava;
+        auto [empurra_ms, soma_empurra] = roda([&](int l, int r) {
+            std::lock_guard<std::mutex> lock(trava);
+            return empurra.query(l, r);
+        });
+
+        // Leitura const compartilhada, sem trava
+        auto [livre_ms, soma_livre] = roda([&](int l, int r) {
+            return leitura.query(l, r);
+        });
+
+        assert(soma_empurra == soma_livre);
+
+        double total = (double)threads * consultas_por_thread;
+        std::cout << "   " << threads << " thread(s): push + trava " << total / empurra_ms / 1000.0
+                  << " Mq/s | const sem trava " << total / livre_ms / 1000.0 << " Mq/s ("
+                  << empurra_ms / livre_ms << "x)\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    std::cout << "🌳 === TESTE DE CONSULTAS CONST - SEGMENT TREE ===\n\n";
+
+    // uso: ./SegTreeConst [n] [consultas por thread]
+    int n = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+    int consultas = argc > 2 ? std::atoi(argv[2]) : 1 << 18;
+
+    unsigned seed = std::random_device{}();
+    std::cout << "🎲 seed: " << seed << "\n\n";
+    std::mt19937 gen(seed);
+
+    testConstComLazy(gen);
+    std::cout << std::endl;
+
+    benchmarkLeituraConcorrente(gen, n, consultas);
+
+    std::cout << "\n🎉 TODOS OS TESTES PASSARAM!\n";
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * Fuzzing diferencial da segTree contra uma implementação naive
+ *
+ * Cada caso sorteia um tamanho (inclusive 1 e não potências de 2), um
+ * TreeType e uma sequência de operações públicas (assign, add, rangeAdd,
+ * rangeAssign, query, queryBatch), comparando cada consulta com o naive.
+ *
+ * Dois modos:
+ * - Normal: ./SegTreeFuzz [seed] [casos]. Cada caso usa seed + i, e em
+ *   caso de erro o seed do caso é impresso para repetir só ele com
+ *   ./SegTreeFuzz <seed do caso> 1
+ * - libFuzzer: compilar com -DSEGTREE_LIBFUZZER e -fsanitize=fuzzer; os
+ *   bytes gerados pelo fuzzer viram as escolhas do caso.
+ *
+ * Os comandos de compilação (com ASan/UBSan e -D_GLIBCXX_ASSERTIONS,
+ * que faz o std::vector conferir os índices) estão no README.
+ */
+
+#include "segTree.hpp"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <limits>
+
+// Implementação naive usando vetores normais
+class NaiveSegTree {
+private:
+    std::vector<int> arr;
+    TreeType type;
+
+public:
+    NaiveSegTree(const std::vector<int>& initial, TreeType t) : arr(initial), type(t) {}
+
+    void rangeAdd(int l, int r, int val) {
+        for (int i = l; i <= r; i++) arr[i] += val;
+    }
+
+    void rangeAssign(int l, int r, int val) {
+        for (int i = l; i <= r; i++) arr[i] = val;
+    }
+
+    void assign(int pos, int val) {
+        arr[pos] = val;
+    }
+
+    void add(int pos, int val) {
+        arr[pos] += val;
+    }
+
+    // Pontas fora de [0, n-1] são limitadas; intervalo vazio (inclusive
+    // l > r) devolve o valor padrão do tipo, como a segTree
+    int query(int l, int r) {
+        l = std::max(l, 0);
+        r = std::min(r, (int)arr.size() - 1);
+        if (l > r) {
+            switch (type) {
+                case SUM: return 0;
+                case MAX: return std::numeric_limits<int>::lowest();
+                case MIN: return std::numeric_limits<int>::max();
+                case GCD: return 0;
+            }
+        }
+
+        int result = arr[l];
+        for (int i = l + 1; i <= r; i++) {
+            switch (type) {
+                case SUM: result += arr[i]; break;
+                case MAX: result = std::max(result, arr[i]); break;
+                case MIN: result = std::min(result, arr[i]); break;
+                case GCD: result = std::gcd(result, arr[i]); break;
+            }
+        }
+        return result;
+    }
+
+    std::string dump() {
+        std::string s;
+        for (int x : arr) s += std::to_string(x) + " ";
+        return s;
+    }
+};
+
+// Fonte de escolhas a partir de um gerador pseudoaleatório
+class FonteAleatoria {
+private:
+    std::mt19937 gen;
+
+public:
+    FonteAleatoria(uint32_t seed) : gen(seed) {}
+
+    bool acabou() { return false; }
+
+    int entre(int a, int b) {
+        return std::uniform_int_distribution<int>(a, b)(gen);
+    }
+};
+
+// Fonte de escolhas a partir dos bytes do libFuzzer
+class FonteBytes {
+private:
+    const uint8_t* dados;
+    size_t tamanho;
+    size_t pos;
+
+public:
+    FonteBytes(const uint8_t* dados, size_t tamanho) : dados(dados), tamanho(tamanho), pos(0) {}
+
+    bool acabou() { return pos >= tamanho; }
+
+    int entre(int a, int b) {
+        uint32_t v = 0;
+        for (int i = 0; i < 4 and pos < tamanho; i++) v = (v << 8) | dados[pos++];
+        return a + (int)(v % (uint32_t)(b - a + 1));
+    }
+};
+
+const char* NOMES[] = {"SUM", "MAX", "MIN", "GCD"};
+
+// Intervalo de uma consulta: quase sempre 0 <= l <= r < n, mas às vezes
+// com pontas fora de [0, n-1] ou invertidas, casos que query e queryBatch
+// tratam à parte. Os updates continuam só com intervalos válidos.
+template<typename Fonte>
+std::pair<int, int> intervaloConsulta(Fonte& fonte, int n) {
+    if (fonte.entre(0, 7) == 0) {
+        return {fonte.entre(-3, n + 2), fonte.entre(-3, n + 2)};
+    }
+    int l = fonte.entre(0, n - 1);
+    int r = fonte.entre(0, n - 1);
+    if (l > r) std::swap(l, r);
+    return {l, r};
+}
+
+// Roda um caso inteiro. Devolve false (e imprime o motivo) na primeira
+// divergência entre a segTree e o naive.
+template<typename Fonte>
+bool rodaCaso(Fonte& fonte, int max_ops) {
+    // Tamanhos pequenos são mais prováveis: é onde moram os erros de borda
+    int n = fonte.entre(0, 3) == 0 ? fonte.entre(1, 300) : fonte.entre(1, 40);
+    TreeType type = static_cast<TreeType>(fonte.entre(0, 3));
+
+    // GCD só com valores não negativos: com negativos o mdc de um único
+    // elemento não é bem definido (a árvore devolve |x|)
+    int val_min = type == GCD ? 0 : -1000;
+    int add_min = type == GCD ? 0 : -100;
+
+    std::vector<int> arr(n);
+    for (auto& x : arr) x = fonte.entre(val_min, 1000);
+
+    segTree<int> tree(arr, type);
+    NaiveSegTree naive(arr, type);
+
+    std::string historico;
+    auto falha = [&](const std::string& motivo) {
+        std::cout << "❌ ERRO (" << NOMES[type] << ", n = " << n << "): " << motivo << "\n"
+                  << "   operações: " << historico << "\n"
+                  << "   naive: " << naive.dump() << std::endl;
+        return false;
+    };
+
+    for (int op = 0; op < max_ops and !fonte.acabou(); op++) {
+        int l = fonte.entre(0, n - 1);
+        int r = fonte.entre(0, n - 1);
+        if (l > r) std::swap(l, r);
+
+        switch (fonte.entre(0, 5)) {
+            case 0: {
+                int val = fonte.entre(val_min, 1000);
+                tree.assign(l, val);
+                naive.assign(l, val);
+                historico += "assign(" + std::to_string(l) + "," + std::to_string(val) + ") ";
+                break;
+            }
+            case 1: {
+                int val = fonte.entre(add_min, 100);
+                tree.add(l, val);
+                naive.add(l, val);
+                historico += "add(" + std::to_string(l) + "," + std::to_string(val) + ") ";
+                break;
+            }
+            case 2: {
+                int val = fonte.entre(add_min, 100);
+                tree.rangeAdd(l, r, val);
+                naive.rangeAdd(l, r, val);
+                historico += "rangeAdd(" + std::to_string(l) + "," + std::to_string(r) + "," + std::to_string(val) + ") ";
+                break;
+            }
+            case 3: {
+                int val = fonte.entre(val_min, 1000);
+                tree.rangeAssign(l, r, val);
+                naive.rangeAssign(l, r, val);
+                historico += "rangeAssign(" + std::to_string(l) + "," + std::to_string(r) + "," + std::to_string(val) + ") ";
+                break;
+            }
+            case 4: {
+                std::tie(l, r) = intervaloConsulta(fonte, n);
+                int seg_result = tree.query(l, r);
+                int naive_result = naive.query(l, r);
+                if (seg_result != naive_result) {
+                    return falha("query(" + std::to_string(l) + "," + std::to_string(r) + ") seg=" +
+                                 std::to_string(seg_result) + " naive=" + std::to_string(naive_result));
+                }
+                break;
+            }
+            case 5: {
+                std::vector<std::pair<int, int>> ranges(fonte.entre(1, 8));
+                for (auto& ab : ranges) ab = intervaloConsulta(fonte, n);
+                int width = fonte.entre(1, 8);
+                std::vector<int> res = tree.queryBatch(ranges, width);
+                for (size_t k = 0; k < ranges.size(); k++) {
+                    int naive_result = naive.query(ranges[k].first, ranges[k].second);
+                    if (res[k] != naive_result) {
+                        return falha("queryBatch width=" + std::to_string(width) + " (" +
+                                     std::to_string(ranges[k].first) + "," + std::to_string(ranges[k].second) +
+                                     ") seg=" + std::to_string(res[k]) + " naive=" + std::to_string(naive_result));
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    // Verificação final completa
+    for (int a = 0; a < n; a++) {
+        for (int b = a; b < n; b++) {
+            if (tree.query(a, b) != naive.query(a, b)) {
+                return falha("verificação final query(" + std::to_string(a) + "," + std::to_string(b) + ")");
+            }
+        }
+    }
+    return true;
+}
+
+#ifdef SEGTREE_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FonteBytes fonte(data, size);
+    if (!rodaCaso(fonte, 200)) std::abort();
+    return 0;
+}
+
+#else
+
+int main(int argc, char** argv) {
+    std::cout << "🌳 === FUZZING DIFERENCIAL - SEGMENT TREE ===\n\n";
+
+    uint32_t seed = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : std::random_device{}();
+    int casos = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    std::cout << "🎲 seed: " << seed << " (" << casos << " casos)\n";
+
+    for (int i = 0; i < casos; i++) {
+        uint32_t seed_caso = seed + i;
+        FonteAleatoria fonte(seed_caso);
+        if (!rodaCaso(fonte, 300)) {
+            std::cout << "🔁 para repetir: " << argv[0] << " " << seed_caso << " 1" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "🎉 TODOS OS CASOS PASSARAM!\n";
+    return 0;
+}
+
+#endif